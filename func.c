@@ -13,6 +13,13 @@ static int file_exists(const char *path);
 static void create_empty_binary_file(const char *path);
 static const char* action_to_string(action_t a);
 static const char* get_field_ptr(const car_t *c, int tf);
+static int string_equals_ci(const char *a, const char *b);
+
+/* Fleet Report Internals */
+static void group_key_of(const car_t *c, group_by_t by, char *key, size_t n);
+static void stats_add(field_stats_t *s, double v);
+static void print_stats_cell(const field_stats_t *s);
+static int cmp_group_key(const void *a, const void *b);
 
 /* Linked List Internal Management */
 static car_node* create_node(const car_t *c);
@@ -46,6 +53,7 @@ static const char* action_to_string(action_t a) {
         case ACT_ADD_CAR:         return "ADD_CAR";
         case ACT_UPDATE_CAR:      return "UPDATE_CAR";
         case ACT_DELETE_CAR:      return "DELETE_CAR";
+        case ACT_FLEET_REPORT:    return "FLEET_REPORT";
         case ACT_SHOW_USERS:      return "SHOW_USERS";
         case ACT_ADD_USER:        return "ADD_USER";
         case ACT_DELETE_USER:     return "DELETE_USER";
@@ -66,6 +74,14 @@ static const char* get_field_ptr(const car_t *c, int tf) {
     }
 }
 
+static int string_equals_ci(const char *a, const char *b) {
+    while (*a && *b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return 0;
+        a++; b++;
+    }
+    return *a == *b;
+}
+
 /* ==========================================================
    SECTION 2: LINKED LIST MANAGEMENT
    ========================================================== */
@@ -195,8 +211,9 @@ void run_main_menu(user_t *current_user) {
         printf("1) Search Car\n2) Add Car\n3) List All Cars\n4) Update Profile\n");
         if (current_user->level >= 2) printf("5) Update Car\n6) Delete Car\n");
         if (current_user->level == 3) printf("7) List Users\n8) Add User\n9) Delete User\n10) Change Level\n");
+        if (current_user->level >= 2) printf("11) Fleet Report\n");
         printf("0) Logout\nChoose: ");
-        int choice = read_int("", 0, 10);
+        int choice = read_int("", 0, 11);
         if (choice == 0) break;
         switch (choice) {
             case 1: cars_search_flow(current_user, car_list); break;
@@ -209,6 +226,7 @@ void run_main_menu(user_t *current_user) {
             case 8: if(current_user->level == 3) add_user(current_user); break;
             case 9: if(current_user->level == 3) users_delete_flow(current_user); break;
             case 10: if(current_user->level == 3) users_change_level_flow(current_user); break;
+            case 11: if(current_user->level >= 2) cars_report_flow(current_user, car_list); break;
         }
     }
     free_list(car_list);
@@ -327,6 +345,118 @@ void cars_delete_by_serial(const user_t *current_user, car_node **head, int seri
     log_action(current_user, ACT_DELETE_CAR, "Deleted car");
 }
 
+/* ==========================================================
+   SECTION 4.1: FLEET REPORT (AGGREGATES)
+   ========================================================== */
+
+static void group_key_of(const car_t *c, group_by_t by, char *key, size_t n) {
+    switch (by) {
+        case GROUP_BY_MAKE:     snprintf(key, n, "%s", c->make); break;
+        case GROUP_BY_COLOR:    snprintf(key, n, "%s", c->color); break;
+        case GROUP_BY_ELECTRIC: snprintf(key, n, "%s", c->is_electric ? "Electric" : "Fuel"); break;
+        case GROUP_BY_YEAR:     snprintf(key, n, "%04d", c->manufacture_date.year); break;
+        default:                key[0] = 0; break;
+    }
+}
+
+static void stats_add(field_stats_t *s, double v) {
+    if (s->count == 0 || v < s->min) s->min = v;
+    if (s->count == 0 || v > s->max) s->max = v;
+    s->sum += v;
+    s->count++;
+}
+
+static void print_stats_cell(const field_stats_t *s) {
+    if (s->count == 0) { printf(" %12s %12s %12s |", "-", "-", "-"); return; }
+    printf(" %12.1f %12.1f %12.1f |", s->sum / s->count, s->min, s->max);
+}
+
+static int cmp_group_key(const void *a, const void *b) {
+    const car_group_t *ga = (const car_group_t*)a, *gb = (const car_group_t*)b;
+    for (int i = 0; ga->key[i] || gb->key[i]; i++) {
+        int ca = tolower((unsigned char)ga->key[i]), cb = tolower((unsigned char)gb->key[i]);
+        if (ca != cb) return ca - cb;
+    }
+    return 0;
+}
+
+/* Single pass over the list; groups are matched case-insensitively */
+car_group_t* cars_group_stats(car_node *head, group_by_t by, size_t *out_count) {
+    car_group_t *groups = NULL;
+    size_t n = 0, cap = 0;
+    char key[MAX_MAKE];
+
+    for (; head; head = head->next) {
+        const car_t *c = &(head->car);
+        group_key_of(c, by, key, sizeof(key));
+
+        size_t i = 0;
+        while (i < n && !string_equals_ci(groups[i].key, key)) i++;
+        if (i == n) {
+            if (n == cap) {
+                size_t new_cap = cap ? cap * 2 : 8;
+                car_group_t *tmp = (car_group_t*)realloc(groups, new_cap * sizeof(car_group_t));
+                if (!tmp) { free(groups); *out_count = 0; return NULL; }
+                groups = tmp; cap = new_cap;
+            }
+            memset(&groups[n], 0, sizeof(car_group_t));
+            strcpy(groups[n].key, key);
+            n++;
+        }
+
+        stats_add(&groups[i].price, c->price);
+        stats_add(&groups[i].mileage, (double)c->mileage);
+        if (c->is_electric) stats_add(&groups[i].range_km, c->range_km);
+    }
+
+    if (n > 1) qsort(groups, n, sizeof(car_group_t), cmp_group_key);
+    *out_count = n;
+    return groups;
+}
+
+void cars_report_flow(const user_t *current_user, car_node *head) {
+    static const char *by_names[] = {"", "Make", "Color", "Type", "Year"};
+
+    if (!head) { printf("Inventory empty.\n"); return; }
+    printf("\n--- Fleet Report ---\n");
+    printf("Group by:\n1) Make\n2) Color\n3) Electric/Fuel\n4) Manufacture Year\n");
+    group_by_t by = (group_by_t)read_int("Choose: ", 1, 4);
+
+    size_t n = 0;
+    car_group_t *groups = cars_group_stats(head, by, &n);
+    if (!groups) { printf("Out of memory.\n"); return; }
+
+    /* Fleet-wide totals are the sum of the per-group aggregates */
+    car_group_t total; memset(&total, 0, sizeof(total));
+    strcpy(total.key, "TOTAL");
+    for (size_t i = 0; i < n; i++) {
+        field_stats_t *src[] = {&groups[i].price, &groups[i].mileage, &groups[i].range_km};
+        field_stats_t *dst[] = {&total.price, &total.mileage, &total.range_km};
+        for (int k = 0; k < 3; k++) {
+            if (src[k]->count == 0) continue;
+            if (dst[k]->count == 0 || src[k]->min < dst[k]->min) dst[k]->min = src[k]->min;
+            if (dst[k]->count == 0 || src[k]->max > dst[k]->max) dst[k]->max = src[k]->max;
+            dst[k]->sum += src[k]->sum;
+            dst[k]->count += src[k]->count;
+        }
+    }
+
+    printf("\n%-20s %5s | %-38s | %-38s | %-38s |\n", by_names[by], "Cars",
+           "Price (avg / min / max)", "Mileage km (avg / min / max)", "Range km (avg / min / max)");
+    for (size_t i = 0; i <= n; i++) {
+        const car_group_t *g = (i < n) ? &groups[i] : &total;
+        printf("%-20.20s %5d |", g->key, g->price.count);
+        print_stats_cell(&g->price);
+        print_stats_cell(&g->mileage);
+        print_stats_cell(&g->range_km);
+        printf("\n");
+    }
+    printf("Groups: %zu\n", n);
+
+    free(groups);
+    log_action(current_user, ACT_FLEET_REPORT, by_names[by]);
+}
+
 /* ==========================================================
    SECTION 5: USER MANAGEMENT
    ========================================================== */
@@ -78,6 +78,30 @@ typedef struct car_node {
     struct car_node *prev;
 } car_node;
 
+/* Aggregate of one numeric field (count/sum/min/max) */
+typedef struct field_stats {
+    int    count;
+    double sum;
+    double min;
+    double max;
+} field_stats_t;
+
+/* One row of a fleet report: all cars sharing the same group key */
+typedef struct car_group {
+    char key[MAX_MAKE];
+    field_stats_t price;
+    field_stats_t mileage;
+    field_stats_t range_km;     /* Electric cars only */
+} car_group_t;
+
+/* Fields a fleet report can be grouped by */
+typedef enum {
+    GROUP_BY_MAKE = 1,
+    GROUP_BY_COLOR,
+    GROUP_BY_ELECTRIC,
+    GROUP_BY_YEAR
+} group_by_t;
+
 /* Action types for logging */
 typedef enum {
     ACT_LOGIN_SUCCESS,
@@ -87,6 +111,7 @@ typedef enum {
     ACT_ADD_CAR,
     ACT_UPDATE_CAR,
     ACT_DELETE_CAR,
+    ACT_FLEET_REPORT,
     ACT_SHOW_USERS,
     ACT_ADD_USER,
     ACT_DELETE_USER,
@@ -113,6 +138,8 @@ void cars_list_all_flow(const user_t *current_user, car_node *head);
 void print_car(const car_t *c);
 void cars_update_by_serial(const user_t *current_user, car_node *head, int serial);
 void cars_delete_by_serial(const user_t *current_user, car_node **head, int serial);
+void cars_report_flow(const user_t *current_user, car_node *head);
+car_group_t* cars_group_stats(car_node *head, group_by_t by, size_t *out_count); /* Caller frees */
 
 /* Users & Profile Operations */
 void users_list_flow(const user_t *current_user);